@@ -23,11 +23,15 @@ CONF_OUTPUT = "output"
 CONF_OUTPUT_ADDRESS = "address"
 CONF_FLUSH_PERIOD = "flush_period"
 CONF_CONTINUOUS_OUTPUT = "continuous_output"
+CONF_PACED = "paced"
+CONF_MAX_PACKETS_PER_MS = "max_packets_per_ms"
 CONF_ROUTE = "route"
 CONF_DMX_ID = "dmx_id"
 CONF_UNIVERSE = "universe"
 CONF_DIRECTION = "direction"
 CONF_ENABLED = "enabled"
+CONF_LATENCY_PROBE = "latency_probe"
+CONF_CHANNEL = "channel"
 
 # Direction enum for routing
 Direction = artnet_ns.enum("Direction")
@@ -49,6 +53,8 @@ CONFIG_SCHEMA = cv.Schema({
         cv.Optional(CONF_SUBNET, default=0): cv.int_range(min=0, max=15),
         cv.Optional(CONF_FLUSH_PERIOD, default="10ms"): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_CONTINUOUS_OUTPUT, default=False): cv.boolean,
+        cv.Optional(CONF_PACED, default=False): cv.boolean,
+        cv.Optional(CONF_MAX_PACKETS_PER_MS, default=0): cv.int_range(min=0, max=1000),
     }),
     cv.Optional(CONF_ROUTE): cv.All(cv.ensure_list(cv.Schema({
         cv.Required(CONF_DMX_ID): cv.use_id(DMXComponent),
@@ -56,6 +62,11 @@ CONFIG_SCHEMA = cv.Schema({
         cv.Required(CONF_DIRECTION): cv.enum(DIRECTION_MODES, lower=True),
         cv.Optional(CONF_ENABLED, default=True): cv.boolean,
     }))),
+    cv.Optional(CONF_LATENCY_PROBE): cv.Schema({
+        cv.Required(CONF_UNIVERSE): cv.int_range(min=0, max=15),
+        # The two channels after the probe channel carry the node's loop time
+        cv.Optional(CONF_CHANNEL, default=1): cv.int_range(min=1, max=510),
+    }),
 }).extend(cv.COMPONENT_SCHEMA)
 
 async def to_code(config):
@@ -90,7 +101,16 @@ async def to_code(config):
             cg.add(var.set_flush_period(output_config[CONF_FLUSH_PERIOD]))
         if CONF_CONTINUOUS_OUTPUT in output_config:
             cg.add(var.set_continuous_output(output_config[CONF_CONTINUOUS_OUTPUT]))
+        if CONF_PACED in output_config:
+            cg.add(var.set_paced_output(output_config[CONF_PACED]))
+        if CONF_MAX_PACKETS_PER_MS in output_config:
+            cg.add(var.set_max_packets_per_ms(output_config[CONF_MAX_PACKETS_PER_MS]))
     
+    # Enable the latency probe echo if present
+    if CONF_LATENCY_PROBE in config:
+        probe_config = config[CONF_LATENCY_PROBE]
+        cg.add(var.set_latency_probe(probe_config[CONF_UNIVERSE], probe_config[CONF_CHANNEL]))
+
     # Set routing configuration if present
     if CONF_ROUTE in config:
         routes = config[CONF_ROUTE]
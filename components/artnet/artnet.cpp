@@ -3,6 +3,7 @@
 #include "artnet_poll_reply.h"
 #include "artnet_sensor.h"
 #include "esphome/components/wifi/wifi_component.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include <cstdint>
 #include <cstring>
@@ -53,12 +54,38 @@ void ArtNet::setup() {
 
   instance_ = this;
 
+  // Allocate packet buffers for every universe we send up front
+  for (const auto &[universe, outputs] : outputs_per_universe_) {
+    this->transmitter_.reserve(calculate_artnet_universe(
+        this->output_net_, this->output_subnet_, universe));
+  }
+#ifdef USE_DMX_COMPONENT
+  for (const auto &route : routes_) {
+    if (route.direction == esphome::artnet::DIRECTION_TO_ARTNET) {
+      this->transmitter_.reserve(calculate_artnet_universe(
+          this->output_net_, this->output_subnet_, route.universe));
+    }
+  }
+#endif
+  if (this->probe_enabled_) {
+    this->transmitter_.reserve(calculate_artnet_universe(
+        this->output_net_, this->output_subnet_, this->probe_universe_));
+  }
+
+  // The transmitter binds the Art-Net port first, so that ArtnetWifi's
+  // receive socket (bound last) is the one lwIP delivers packets to
+  if (!this->transmitter_.begin()) {
+    this->mark_failed();
+    return;
+  }
+
   artnet_ = new ArtnetWifi();
   artnet_->begin();
 }
 
 void ArtNet::loop() {
   if (wifi::global_wifi_component->is_connected()) {
+    this->loop_start_us_ = micros();
     uint32_t opcode = artnet_get_latest();
     if (opcode != 0) {
       ESP_LOGV(TAG, "Received Art-Net frame with opcode: %u", opcode);
@@ -83,15 +110,19 @@ void ArtNet::loop() {
       this->poll_reply_sender_ip_ = IPAddress(0, 0, 0, 0); // Clear
     }
 
-    // Check if it's time to flush outputs
+    // Check if it's time to schedule the next flush
     if (now - this->last_flush_time_ >= this->flush_period_ms_) {
       this->last_flush_time_ = now;
-      this->send_outputs_data();
+      this->queue_outputs_data();
 
 #ifdef USE_DMX_COMPONENT
-      this->route_dmx_to_artnet();
+      this->queue_dmx_to_artnet();
 #endif
+      this->tx_scheduler_.commit(now, this->flush_period_ms_);
     }
+
+    this->process_tx_queue(now);
+    this->log_tx_stats(now);
   }
 }
 
@@ -100,6 +131,16 @@ void ArtNet::dump_config() {
   ESP_LOGCONFIG(TAG, "  Listening for ArtNet packets");
   ESP_LOGCONFIG(TAG, "  Output Address: %s",
                 this->output_address_.toString().c_str());
+  ESP_LOGCONFIG(TAG, "  Paced Output: %s",
+                YESNO(this->tx_scheduler_.is_paced()));
+  if (this->tx_scheduler_.get_max_packets_per_ms() > 0) {
+    ESP_LOGCONFIG(TAG, "  Max Packets/ms: %u",
+                  this->tx_scheduler_.get_max_packets_per_ms());
+  }
+  if (this->probe_enabled_) {
+    ESP_LOGCONFIG(TAG, "  Latency Probe: universe %d, channel %d",
+                  this->probe_universe_, this->probe_channel_);
+  }
 
 #ifdef USE_DMX_COMPONENT
   // Log routing configuration
@@ -119,7 +160,7 @@ void ArtNet::dump_config() {
 #endif
 }
 
-void ArtNet::send_outputs_data() {
+void ArtNet::queue_outputs_data() {
   for (const auto &[universe, outputs] : outputs_per_universe_) {
     bool has_changes = false;
     for (auto *output : outputs) {
@@ -129,28 +170,81 @@ void ArtNet::send_outputs_data() {
       }
     }
 
-    // quit early, if we don't have any changes to send for this universe
+    // skip, if we don't have any changes to send for this universe
     if (!has_changes && !this->continuous_output_) {
       continue;
     }
 
-    uint8_t *buffer = artnet_->getDmxFrame();
-    // Clear DMX buffer
-    memset(buffer, 0, DMX_MAX_CHANNELS);
+    this->tx_scheduler_.enqueue(universe, TX_SOURCE_OUTPUTS, has_changes);
+  }
+}
 
-    for (auto *output : outputs) {
-      uint16_t channel = output->get_channel();
-      if (channel >= 1 && channel <= DMX_MAX_CHANNELS) {
-        buffer[channel - 1] = output->get_current_value();
-        output->set_changes_flushed();
-      }
+void ArtNet::process_tx_queue(uint32_t now) {
+  TxRequest request;
+  while (this->tx_scheduler_.pop_due(now, request)) {
+    if (request.source == TX_SOURCE_OUTPUTS) {
+      this->send_outputs_data(request.universe);
+    } else {
+      this->route_dmx_to_artnet(request.source);
     }
+  }
 
-    uint16_t full_universe = calculate_artnet_universe(
-        this->output_net_, this->output_subnet_, universe);
-    artnet_->setUniverse(full_universe);
-    artnet_->setLength(DMX_MAX_CHANNELS);
-    artnet_->write(output_address_);
+  // Submit everything due in this loop() as one batch
+  ArtNetTxResult result = this->transmitter_.flush();
+  this->tx_scheduler_.record_results(result.sent, result.failed);
+
+  // Only run loop() faster than usual when the next paced slot would
+  // otherwise be missed
+  if (this->tx_scheduler_.get_time_until_due(now) < App.get_loop_interval()) {
+    this->high_freq_.start();
+  } else {
+    this->high_freq_.stop();
+  }
+}
+
+void ArtNet::send_outputs_data(uint16_t universe) {
+  auto it = outputs_per_universe_.find(universe);
+  if (it == outputs_per_universe_.end()) {
+    return;
+  }
+
+  uint16_t full_universe = calculate_artnet_universe(
+      this->output_net_, this->output_subnet_, universe);
+  uint8_t *buffer = this->transmitter_.get_payload(full_universe);
+  // Clear DMX buffer
+  memset(buffer, 0, DMX_MAX_CHANNELS);
+
+  for (auto *output : it->second) {
+    uint16_t channel = output->get_channel();
+    if (channel >= 1 && channel <= DMX_MAX_CHANNELS) {
+      buffer[channel - 1] = output->get_current_value();
+      output->set_changes_flushed();
+    }
+  }
+
+  this->transmitter_.queue(full_universe, DMX_MAX_CHANNELS,
+                           this->output_address_);
+}
+
+void ArtNet::log_tx_stats(uint32_t now) {
+  if (now - this->last_tx_stats_time_ < TX_STATS_LOG_INTERVAL_MS) {
+    return;
+  }
+  this->last_tx_stats_time_ = now;
+
+  uint32_t deferred = this->tx_scheduler_.get_deferred_count();
+  uint32_t errors = this->tx_scheduler_.get_error_count();
+  if (deferred != this->last_tx_stats_deferred_ ||
+      errors != this->last_tx_stats_errors_) {
+    ESP_LOGD(TAG,
+             "TX stats: sent=%u, deferred=%u (+%u), errors=%u (+%u), "
+             "queue depth=%u",
+             this->tx_scheduler_.get_sent_count(), deferred,
+             deferred - this->last_tx_stats_deferred_, errors,
+             errors - this->last_tx_stats_errors_,
+             static_cast<uint32_t>(this->tx_scheduler_.get_queue_depth()));
+    this->last_tx_stats_deferred_ = deferred;
+    this->last_tx_stats_errors_ = errors;
   }
 }
 
@@ -185,40 +279,64 @@ void ArtNet::handle_artnet_dmx_frame() {
 
   // Route ArtNet data to DMX if configured
   route_artnet_to_dmx(universe, data, length);
+
+  // Echo the probe channel last, once sensors and routes are done with
+  // `data`, so the measured software path covers the full receive handling
+  if (this->probe_enabled_ && universe == this->probe_universe_ &&
+      this->probe_channel_ <= length) {
+    this->send_probe_echo(data[this->probe_channel_ - 1]);
+  }
 }
-void ArtNet::route_dmx_to_artnet() {
+
+void ArtNet::queue_dmx_to_artnet() {
 #ifdef USE_DMX_COMPONENT
   // Iterate over all routes, filtering for DMX to ArtNet direction
-  for (const auto &route : routes_) {
+  for (size_t i = 0; i < routes_.size(); i++) {
+    const auto &route = routes_[i];
     // Skip if not enabled or wrong direction
     if (!route.enabled ||
         route.direction != esphome::artnet::DIRECTION_TO_ARTNET) {
       continue;
     }
 
-    esphome::dmx::DMXComponent *dmx_component =
-        static_cast<esphome::dmx::DMXComponent *>(route.dmx_component);
-    uint16_t universe = route.universe;
+    // Routed DMX input is live data, so it takes priority over keepalives
+    this->tx_scheduler_.enqueue(route.universe, static_cast<int16_t>(i), true);
+  }
+#endif
+}
 
-    if (dmx_component == nullptr) {
-      ESP_LOGW(TAG, "DMX component pointer is null for routing");
-      continue;
-    }
+void ArtNet::route_dmx_to_artnet(size_t route_index) {
+#ifdef USE_DMX_COMPONENT
+  if (route_index >= routes_.size()) {
+    return;
+  }
 
-    // Prepare DMX buffer
-    uint8_t *dmx_data = artnet_->getDmxFrame();
+  // The route may have been changed since it was queued
+  const auto &route = routes_[route_index];
+  if (!route.enabled ||
+      route.direction != esphome::artnet::DIRECTION_TO_ARTNET) {
+    return;
+  }
 
-    // Read the full DMX universe from the DMX component
-    dmx_component->read_universe(dmx_data, DMX_MAX_CHANNELS);
+  esphome::dmx::DMXComponent *dmx_component =
+      static_cast<esphome::dmx::DMXComponent *>(route.dmx_component);
+  uint16_t universe = route.universe;
 
-    // Send the DMX data as an Art-Net frame
-    uint16_t full_universe = calculate_artnet_universe(
-        this->output_net_, this->output_subnet_, universe);
-    artnet_->setUniverse(full_universe);
-    artnet_->setLength(DMX_MAX_CHANNELS);
-    artnet_->write(output_address_);
-    ESP_LOGVV(TAG, "Sent frame from DMX to Art-Net for universe %d", universe);
+  if (dmx_component == nullptr) {
+    ESP_LOGW(TAG, "DMX component pointer is null for routing");
+    return;
   }
+
+  // Read the full DMX universe straight into the outgoing packet
+  uint16_t full_universe = calculate_artnet_universe(
+      this->output_net_, this->output_subnet_, universe);
+  uint8_t *dmx_data = this->transmitter_.get_payload(full_universe);
+  dmx_component->read_universe(dmx_data, DMX_MAX_CHANNELS);
+
+  // Queue the DMX data as an Art-Net frame
+  this->transmitter_.queue(full_universe, DMX_MAX_CHANNELS,
+                           this->output_address_);
+  ESP_LOGVV(TAG, "Queued frame from DMX to Art-Net for universe %d", universe);
 #endif
 }
 
@@ -262,15 +380,62 @@ void ArtNet::send_poll_reply() {
                        this->poll_response_counter_);
 
   // Send the reply via UDP to the sender's IP
-  WiFiUDP Udp;
-  Udp.beginPacket(this->poll_reply_sender_ip_, ART_NET_PORT);
-  Udp.write(poll_reply, sizeof(poll_reply));
-  Udp.endPacket();
+  bool sent = this->transmitter_.send(this->poll_reply_sender_ip_, poll_reply,
+                                      sizeof(poll_reply));
+  this->tx_scheduler_.record_results(sent ? 1 : 0, sent ? 0 : 1);
 
   ESP_LOGD(TAG, "Sent ArtPollReply to %s",
            this->poll_reply_sender_ip_.toString().c_str());
 }
 
+// Sends an ArtDmx frame carrying the probe value on the probe channel and the
+// time spent in loop() so far (microseconds, 16-bit big-endian, saturated) on
+// the two channels after it. The host-side tool uses the latter to split
+// round-trip time into software and network components.
+void ArtNet::send_probe_echo(uint8_t value) {
+  // Echo to the configured output address, or back to the sender if none
+  IPAddress target = this->output_address_;
+  if (target == IPAddress(0, 0, 0, 0)) {
+    target = artnet_->getSenderIp();
+  }
+
+  uint16_t full_universe = calculate_artnet_universe(
+      this->output_net_, this->output_subnet_, this->probe_universe_);
+  uint8_t *buffer = this->transmitter_.get_payload(full_universe);
+  memset(buffer, 0, DMX_MAX_CHANNELS);
+
+  uint32_t elapsed_us = micros() - this->loop_start_us_;
+  uint16_t reported_us = elapsed_us > 0xFFFF ? 0xFFFF : elapsed_us;
+  buffer[this->probe_channel_ - 1] = value;
+  buffer[this->probe_channel_] = reported_us >> 8;
+  buffer[this->probe_channel_ + 1] = reported_us & 0xFF;
+
+  // Sent on its own, ahead of anything the scheduler has pending
+  this->transmitter_.queue(full_universe, DMX_MAX_CHANNELS, target);
+  ArtNetTxResult result = this->transmitter_.flush();
+  this->tx_scheduler_.record_results(result.sent, result.failed);
+
+  // Track the full software path including the send itself
+  elapsed_us = micros() - this->loop_start_us_;
+  this->probe_count_++;
+  this->probe_total_us_ += elapsed_us;
+  if (elapsed_us < this->probe_min_us_) {
+    this->probe_min_us_ = elapsed_us;
+  }
+  if (elapsed_us > this->probe_max_us_) {
+    this->probe_max_us_ = elapsed_us;
+  }
+
+  ESP_LOGV(TAG, "Echoed probe value %d to %s in %u us", value,
+           target.toString().c_str(), elapsed_us);
+  if (this->probe_count_ % 100 == 0) {
+    ESP_LOGD(TAG, "Latency probe: %u echoes, loop min/avg/max %u/%u/%u us",
+             this->probe_count_, this->probe_min_us_,
+             static_cast<uint32_t>(this->probe_total_us_ / this->probe_count_),
+             this->probe_max_us_);
+  }
+}
+
 // Discard all packets except the latest one
 uint32_t ArtNet::artnet_get_latest() {
   uint32_t last_opcode = 0;
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "artnet_transmitter.h"
+#include "artnet_tx_scheduler.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include <ArtnetWifi.h>
 #include <WiFi.h>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <utility>
@@ -58,6 +62,23 @@ public:
     this->continuous_output_ = continuous_output;
   }
 
+  void set_paced_output(bool paced) { this->tx_scheduler_.set_paced(paced); }
+
+  void set_max_packets_per_ms(uint16_t max_packets) {
+    this->tx_scheduler_.set_max_packets_per_ms(max_packets);
+  }
+
+  // Transmit statistics, e.g. for template sensors
+  size_t get_tx_queue_depth() const {
+    return this->tx_scheduler_.get_queue_depth();
+  }
+  uint32_t get_tx_deferred_count() const {
+    return this->tx_scheduler_.get_deferred_count();
+  }
+  uint32_t get_tx_error_count() const {
+    return this->tx_scheduler_.get_error_count();
+  }
+
   void set_name_short(const std::string &name_short) {
     this->name_short_ = name_short;
   }
@@ -96,6 +117,16 @@ public:
   }
   uint8_t get_subnet() const { return this->subnet_; }
 
+  // Echo the given channel of incoming ArtDmx frames on `universe` straight
+  // back out, for measuring end-to-end latency
+  void set_latency_probe(uint16_t universe, uint16_t channel) {
+    if (universe <= 15 && channel >= 1 && channel <= 510) {
+      this->probe_universe_ = universe;
+      this->probe_channel_ = channel;
+      this->probe_enabled_ = true;
+    }
+  }
+
 #ifdef USE_DMX_COMPONENT
   void add_route(esphome::dmx::DMXComponent *dmx_component, uint16_t universe,
                  Direction direction, bool enabled) {
@@ -154,7 +185,28 @@ protected:
   static const uint32_t POLL_REPLY_MAX_DELAY_MS =
       1000; // Random delay up to 1s before sending reply
 
-  void send_outputs_data();
+  // Latency probe state
+  bool probe_enabled_{false};
+  uint16_t probe_universe_{0};
+  uint16_t probe_channel_{1};
+  uint32_t loop_start_us_{0};
+  uint32_t probe_count_{0};
+  uint32_t probe_min_us_{UINT32_MAX};
+  uint32_t probe_max_us_{0};
+  uint64_t probe_total_us_{0};
+
+  ArtNetTransmitter transmitter_;
+  TxScheduler tx_scheduler_;
+  HighFrequencyLoopRequester high_freq_;
+  uint32_t last_tx_stats_time_{0};
+  uint32_t last_tx_stats_deferred_{0};
+  uint32_t last_tx_stats_errors_{0};
+  static const uint32_t TX_STATS_LOG_INTERVAL_MS = 10000;
+
+  void queue_outputs_data();
+  void process_tx_queue(uint32_t now);
+  void send_outputs_data(uint16_t universe);
+  void log_tx_stats(uint32_t now);
 
   virtual void handle_artnet_dmx_frame();
 
@@ -162,9 +214,11 @@ protected:
   std::vector<Route> routes_;
 #endif
 
-  void route_dmx_to_artnet();
+  void queue_dmx_to_artnet();
+  void route_dmx_to_artnet(size_t route_index);
   void route_artnet_to_dmx(uint8_t universe, uint8_t *data, uint16_t length);
   void send_poll_reply();
+  void send_probe_echo(uint8_t value);
   static uint32_t artnet_get_latest();
 };
 
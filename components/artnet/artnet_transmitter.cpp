@@ -0,0 +1,225 @@
+#include "artnet_transmitter.h"
+#include "artnet_poll_reply.h"
+#include "esphome/core/log.h"
+#include <cstring>
+
+#ifdef USE_ESP32
+#include "lwip/ip_addr.h"
+#include "lwip/pbuf.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "lwip/udp.h"
+#endif
+
+namespace esphome::artnet {
+
+static const char *const TAG = "artnet.transmitter";
+
+#define ART_NET_ID "Art-Net"
+static const uint16_t ART_DMX_OPCODE = 0x5000;
+static const uint16_t ART_PROTOCOL_VERSION = 14;
+
+#ifdef USE_ESP32
+// lwIP raw API calls must run on the TCP/IP thread
+struct PcbNewCall {
+  struct tcpip_api_call_data call;
+  struct udp_pcb *pcb;
+};
+
+static err_t pcb_new_callback(struct tcpip_api_call_data *api_call) {
+  auto *call = reinterpret_cast<PcbNewCall *>(api_call);
+  call->pcb = udp_new();
+  if (call->pcb == nullptr) {
+    return ERR_MEM;
+  }
+  // Art-Net uses 6454 as both source and destination port. ArtnetWifi's
+  // receive socket is bound to it as well, hence SOF_REUSEADDR.
+#if SO_REUSE
+  ip_set_option(call->pcb, SOF_REUSEADDR);
+  u16_t port = ART_PORT;
+#else
+  // Binding the Art-Net port here would make ArtnetWifi's bind fail
+  u16_t port = 0;
+#endif
+  // Broadcast output addresses are common for Art-Net
+  ip_set_option(call->pcb, SOF_BROADCAST);
+  err_t err = udp_bind(call->pcb, IP_ADDR_ANY, port);
+  if (err != ERR_OK) {
+    udp_remove(call->pcb);
+    call->pcb = nullptr;
+  }
+  return err;
+}
+
+struct SendCall {
+  struct tcpip_api_call_data call;
+  struct udp_pcb *pcb;
+  const ArtNetDatagram *datagrams;
+  size_t count;
+  size_t failed;
+};
+
+static err_t send_callback(struct tcpip_api_call_data *api_call) {
+  auto *call = reinterpret_cast<SendCall *>(api_call);
+  for (size_t i = 0; i < call->count; i++) {
+    const ArtNetDatagram &datagram = call->datagrams[i];
+
+    // Copy into a pbuf with room for the headers, so lwIP owns the data and
+    // the packet buffer is free for reuse whatever the driver does with it
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, datagram.length, PBUF_RAM);
+    if (p == nullptr) {
+      call->failed++;
+      continue;
+    }
+    pbuf_take(p, datagram.data, datagram.length);
+
+    ip_addr_t addr;
+    IP_ADDR4(&addr, datagram.ip[0], datagram.ip[1], datagram.ip[2],
+             datagram.ip[3]);
+    if (udp_sendto(call->pcb, p, &addr, ART_PORT) != ERR_OK) {
+      call->failed++;
+    }
+    pbuf_free(p);
+  }
+  return ERR_OK;
+}
+#endif
+
+bool ArtNetTransmitter::begin() {
+#ifdef USE_ESP32
+  PcbNewCall call{};
+  tcpip_api_call(pcb_new_callback, &call.call);
+  this->pcb_ = call.pcb;
+  if (this->pcb_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to create UDP socket");
+    return false;
+  }
+#if !SO_REUSE
+  ESP_LOGW(TAG, "lwIP built without SO_REUSE, sending from an ephemeral port");
+#endif
+#endif
+  this->batch_.reserve(this->packets_.size());
+  return true;
+}
+
+void ArtNetTransmitter::reserve(uint16_t full_universe) {
+  this->get_packet(full_universe);
+  this->batch_.reserve(this->packets_.size());
+}
+
+ArtDmxPacket *ArtNetTransmitter::get_packet(uint16_t full_universe) {
+  auto &packet = this->packets_[full_universe];
+  if (packet) {
+    return packet.get();
+  }
+
+  packet = std::make_unique<ArtDmxPacket>();
+  uint8_t *data = packet->data;
+  memset(data, 0, sizeof(packet->data));
+
+  // ID (8 bytes at offset 0-7): "Art-Net\0"
+  memcpy(data, ART_NET_ID, strlen(ART_NET_ID));
+  // OpCode (2 bytes at offset 8-9, little-endian)
+  data[8] = ART_DMX_OPCODE & 0xFF;
+  data[9] = ART_DMX_OPCODE >> 8;
+  // Protocol version (2 bytes at offset 10-11, big-endian)
+  data[10] = ART_PROTOCOL_VERSION >> 8;
+  data[11] = ART_PROTOCOL_VERSION & 0xFF;
+  // Sequence (offset 12) is set per send, physical (offset 13) stays 0
+  // SubUni and Net (2 bytes at offset 14-15)
+  data[14] = full_universe & 0xFF;
+  data[15] = (full_universe >> 8) & 0x7F;
+
+  packet->sequence = 0;
+  packet->queued = false;
+  return packet.get();
+}
+
+uint8_t *ArtNetTransmitter::get_payload(uint16_t full_universe) {
+  ArtDmxPacket *packet = this->get_packet(full_universe);
+  // Another source already queued this universe; send it before the buffer
+  // is overwritten
+  if (packet->queued) {
+    this->send_batch();
+  }
+  return packet->data + ART_DMX_HEADER_LENGTH;
+}
+
+void ArtNetTransmitter::queue(uint16_t full_universe, uint16_t length,
+                              const IPAddress &ip) {
+  ArtDmxPacket *packet = this->get_packet(full_universe);
+
+  // Sequence runs 1-255; 0 would tell receivers sequencing is disabled
+  packet->sequence = packet->sequence == 255 ? 1 : packet->sequence + 1;
+  packet->data[12] = packet->sequence;
+  // Length (2 bytes at offset 16-17, big-endian)
+  packet->data[16] = length >> 8;
+  packet->data[17] = length & 0xFF;
+  packet->queued = true;
+
+  this->batch_.push_back(
+      {packet->data, static_cast<uint16_t>(ART_DMX_HEADER_LENGTH + length), ip});
+}
+
+void ArtNetTransmitter::send_batch() {
+  if (this->batch_.empty()) {
+    return;
+  }
+  size_t failed = this->send_datagrams(this->batch_.data(), this->batch_.size());
+  if (failed > 0) {
+    ESP_LOGV(TAG, "%u of %u packets failed to send",
+             static_cast<uint32_t>(failed),
+             static_cast<uint32_t>(this->batch_.size()));
+  }
+  this->result_.sent += this->batch_.size() - failed;
+  this->result_.failed += failed;
+
+  for (auto &[universe, packet] : this->packets_) {
+    packet->queued = false;
+  }
+  this->batch_.clear();
+}
+
+ArtNetTxResult ArtNetTransmitter::flush() {
+  this->send_batch();
+  ArtNetTxResult result = this->result_;
+  this->result_ = {0, 0};
+  return result;
+}
+
+bool ArtNetTransmitter::send(const IPAddress &ip, const uint8_t *data,
+                             size_t length) {
+  ArtNetDatagram datagram{data, static_cast<uint16_t>(length), ip};
+  return this->send_datagrams(&datagram, 1) == 0;
+}
+
+size_t ArtNetTransmitter::send_datagrams(const ArtNetDatagram *datagrams,
+                                         size_t count) {
+#ifdef USE_ESP32
+  if (this->pcb_ == nullptr) {
+    return count;
+  }
+  // One round trip into the TCP/IP thread for the whole batch
+  SendCall call{};
+  call.pcb = this->pcb_;
+  call.datagrams = datagrams;
+  call.count = count;
+  tcpip_api_call(send_callback, &call.call);
+  return call.failed;
+#else
+  size_t failed = 0;
+  for (size_t i = 0; i < count; i++) {
+    const ArtNetDatagram &datagram = datagrams[i];
+    if (!this->udp_.beginPacket(datagram.ip, ART_PORT)) {
+      failed++;
+      continue;
+    }
+    this->udp_.write(datagram.data, datagram.length);
+    if (!this->udp_.endPacket()) {
+      failed++;
+    }
+  }
+  return failed;
+#endif
+}
+
+} // namespace esphome::artnet
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <IPAddress.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifdef USE_ESP32
+struct udp_pcb;
+#else
+#include <WiFiUdp.h>
+#endif
+
+namespace esphome::artnet {
+
+static const uint16_t ART_DMX_HEADER_LENGTH = 18;
+static const uint16_t ART_DMX_MAX_LENGTH = 512;
+
+// One queued UDP packet to the Art-Net port of `ip`
+struct ArtNetDatagram {
+  const uint8_t *data;
+  uint16_t length;
+  IPAddress ip;
+};
+
+// Preallocated ArtDmx packet for one universe. The header is built once;
+// only the sequence, length and payload change between sends.
+struct ArtDmxPacket {
+  uint8_t data[ART_DMX_HEADER_LENGTH + ART_DMX_MAX_LENGTH];
+  uint8_t sequence;
+  bool queued; // Referenced by the current batch
+};
+
+// Outcome of the packets submitted by a flush()
+struct ArtNetTxResult {
+  size_t sent;
+  size_t failed;
+};
+
+/**
+ * Sends Art-Net packets over one persistent UDP socket.
+ *
+ * ArtDmx payloads are written straight into per-universe packet buffers
+ * (get_payload()), queued for a destination (queue()) and submitted together
+ * by flush(). On ESP32 the whole batch goes through the lwIP raw API in a
+ * single call into the TCP/IP thread; each packet is copied once into a
+ * PBUF_RAM pbuf there, so the packet buffers can be reused as soon as
+ * flush() returns. Elsewhere it falls back to a persistent WiFiUDP, which
+ * sends from an ephemeral port since the Art-Net port is taken by ArtnetWifi.
+ *
+ * A universe has one packet buffer, so if get_payload() is called for a
+ * universe that is already in the batch (e.g. an output and a route sharing
+ * it), the batch is sent first so neither frame is overwritten.
+ *
+ * On ESP32 the pcb is bound to the Art-Net port (with SO_REUSEADDR), so
+ * packets go out with 6454 as their source port. begin() must run before
+ * ArtnetWifi's begin(): lwIP hands unicast packets to the most recently
+ * bound pcb, which then has to be the ArtnetWifi receive socket. If lwIP is
+ * built without SO_REUSE, the pcb binds an ephemeral port instead so that
+ * ArtnetWifi can still bind the Art-Net port.
+ */
+class ArtNetTransmitter {
+public:
+  bool begin();
+
+  // Allocates the packet buffer for a universe ahead of time
+  void reserve(uint16_t full_universe);
+
+  // Returns the DMX payload buffer for a universe, to be filled before queue()
+  uint8_t *get_payload(uint16_t full_universe);
+
+  // Adds a universe's packet to the current batch
+  void queue(uint16_t full_universe, uint16_t length, const IPAddress &ip);
+
+  // Sends the current batch. The result also covers any batch sent early by
+  // get_payload() since the last flush().
+  ArtNetTxResult flush();
+
+  // Sends a single packet immediately over the persistent socket
+  bool send(const IPAddress &ip, const uint8_t *data, size_t length);
+
+protected:
+  ArtDmxPacket *get_packet(uint16_t full_universe);
+  void send_batch();
+  // Returns the number of datagrams that failed to send
+  size_t send_datagrams(const ArtNetDatagram *datagrams, size_t count);
+
+  std::map<uint16_t, std::unique_ptr<ArtDmxPacket>> packets_;
+  std::vector<ArtNetDatagram> batch_;
+  ArtNetTxResult result_{0, 0};
+
+#ifdef USE_ESP32
+  struct udp_pcb *pcb_{nullptr};
+#else
+  WiFiUDP udp_;
+#endif
+};
+
+} // namespace esphome::artnet
@@ -0,0 +1,94 @@
+#include "artnet_tx_scheduler.h"
+#include <algorithm>
+
+namespace esphome::artnet {
+
+void TxScheduler::enqueue(uint16_t universe, int16_t source, bool fresh) {
+  // A universe still waiting from the previous period keeps its slot and
+  // reads the latest data when sent. If it now carries changes, pop_due()
+  // will pick it ahead of due keepalives.
+  for (auto &request : this->queue_) {
+    if (request.universe == universe && request.source == source) {
+      request.fresh |= fresh;
+      return;
+    }
+  }
+  this->pending_.push_back({universe, source, fresh, false, 0});
+}
+
+void TxScheduler::commit(uint32_t now, uint32_t period_ms) {
+  // Fresh changes go first, keepalives fill the rest of the period
+  std::stable_partition(this->pending_.begin(), this->pending_.end(),
+                        [](const TxRequest &request) { return request.fresh; });
+
+  size_t count = this->pending_.size();
+  for (size_t i = 0; i < count; i++) {
+    TxRequest &request = this->pending_[i];
+    request.due_ms = this->paced_ ? now + (period_ms * i) / count : now;
+    this->queue_.push_back(request);
+  }
+  this->pending_.clear();
+}
+
+bool TxScheduler::pop_due(uint32_t now, TxRequest &request) {
+  if (this->queue_.empty()) {
+    return false;
+  }
+
+  // Pick the first due request, preferring fresh changes over keepalives.
+  // Leftovers from earlier periods sit ahead of newly committed requests, so
+  // FIFO order alone would let deferred keepalives starve fresh changes.
+  auto next = this->queue_.end();
+  for (auto it = this->queue_.begin(); it != this->queue_.end(); ++it) {
+    if (static_cast<int32_t>(now - it->due_ms) < 0) {
+      continue;
+    }
+    if (next == this->queue_.end() || (it->fresh && !next->fresh)) {
+      next = it;
+    }
+    if (next->fresh) {
+      break;
+    }
+  }
+  if (next == this->queue_.end()) {
+    return false;
+  }
+
+  if (this->max_packets_per_ms_ > 0) {
+    if (now != this->budget_ms_) {
+      this->budget_ms_ = now;
+      this->budget_used_ = 0;
+    }
+    if (this->budget_used_ >= this->max_packets_per_ms_) {
+      if (!next->deferred) {
+        next->deferred = true;
+        this->deferred_count_++;
+      }
+      return false;
+    }
+    this->budget_used_++;
+  }
+
+  request = *next;
+  this->queue_.erase(next);
+  return true;
+}
+
+uint32_t TxScheduler::get_time_until_due(uint32_t now) const {
+  uint32_t wait = UINT32_MAX;
+  for (const auto &request : this->queue_) {
+    int32_t remaining = static_cast<int32_t>(request.due_ms - now);
+    if (remaining <= 0) {
+      return 0;
+    }
+    wait = std::min(wait, static_cast<uint32_t>(remaining));
+  }
+  return wait;
+}
+
+void TxScheduler::record_results(size_t sent, size_t failed) {
+  this->sent_count_ += sent;
+  this->error_count_ += failed;
+}
+
+} // namespace esphome::artnet
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace esphome::artnet {
+
+// Source of a scheduled universe send
+static const int16_t TX_SOURCE_OUTPUTS = -1; // ArtNetOutput channels
+// Values >= 0 are indices into the DMX -> ArtNet route list
+
+struct TxRequest {
+  uint16_t universe;
+  int16_t source;
+  bool fresh;    // Carries changes, as opposed to a keepalive resend
+  bool deferred; // Already counted as deferred by the packet budget
+  uint32_t due_ms;
+};
+
+/**
+ * Spreads the universes due in a flush period evenly across that period and
+ * caps how many packets go out per millisecond, so a flush does not burst
+ * every universe into the WiFi TX queue at once.
+ *
+ * Universes are queued with enqueue() and released together by commit(),
+ * which orders fresh changes ahead of keepalives and assigns each one a send
+ * slot. pop_due() then hands out requests as their slot comes up, preferring
+ * fresh changes when several are due.
+ */
+class TxScheduler {
+public:
+  void set_paced(bool paced) { this->paced_ = paced; }
+  bool is_paced() const { return this->paced_; }
+
+  // 0 disables the budget
+  void set_max_packets_per_ms(uint16_t max_packets) {
+    this->max_packets_per_ms_ = max_packets;
+  }
+  uint16_t get_max_packets_per_ms() const { return this->max_packets_per_ms_; }
+
+  void enqueue(uint16_t universe, int16_t source, bool fresh);
+  void commit(uint32_t now, uint32_t period_ms);
+  bool pop_due(uint32_t now, TxRequest &request);
+  // Milliseconds until the next request is due, UINT32_MAX if none queued
+  uint32_t get_time_until_due(uint32_t now) const;
+  void record_results(size_t sent, size_t failed);
+
+  size_t get_queue_depth() const { return this->queue_.size(); }
+  uint32_t get_sent_count() const { return this->sent_count_; }
+  uint32_t get_deferred_count() const { return this->deferred_count_; }
+  uint32_t get_error_count() const { return this->error_count_; }
+
+protected:
+  std::deque<TxRequest> queue_;
+  std::deque<TxRequest> pending_;
+  bool paced_{false};
+  uint16_t max_packets_per_ms_{0};
+  uint32_t budget_ms_{0};
+  uint16_t budget_used_{0};
+  uint32_t sent_count_{0};
+  uint32_t deferred_count_{0};
+  uint32_t error_count_{0};
+};
+
+} // namespace esphome::artnet
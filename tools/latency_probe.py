@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""Measure Art-Net round-trip latency against a node with `latency_probe` enabled.
+
+Sends ArtDmx frames with a changing value on the probe channel and waits for the
+node to echo it back. The node writes the time it spent inside ArtNet::loop()
+on the two channels after the probe channel, so each round trip is split into
+software time (on the node) and everything else: network, host stack, and the
+time the frame waits on the node for the next main loop pass (up to the loop
+interval, ~16ms by default, which is often the largest part on ESP32).
+
+Examples:
+  # Probe a node on universe 15, channel 1
+  ./latency_probe.py 10.1.1.50 --universe 15
+
+  # Benchmark the tool and host UDP stack against a built-in local reflector
+  ./latency_probe.py --loopback
+"""
+
+import argparse
+import socket
+import statistics
+import sys
+import threading
+import time
+
+ART_NET_PORT = 6454
+ART_NET_ID = b"Art-Net\x00"
+ART_DMX = 0x5000
+DMX_MAX_CHANNELS = 512
+
+
+def build_art_dmx(full_universe, sequence, data):
+    """Builds an ArtDmx packet for the given 15-bit universe address."""
+    header = bytearray(ART_NET_ID)
+    header += bytes([ART_DMX & 0xFF, ART_DMX >> 8])  # OpCode, little-endian
+    header += bytes([0, 14])  # Protocol version, big-endian
+    header += bytes([sequence, 0])  # Sequence, physical
+    header += bytes([full_universe & 0xFF, (full_universe >> 8) & 0x7F])
+    header += bytes([len(data) >> 8, len(data) & 0xFF])  # Length, big-endian
+    return bytes(header) + bytes(data)
+
+
+def parse_art_dmx(packet):
+    """Returns (full_universe, data) for an ArtDmx packet, or None."""
+    if len(packet) < 18 or packet[:8] != ART_NET_ID:
+        return None
+    if packet[8] | (packet[9] << 8) != ART_DMX:
+        return None
+    full_universe = packet[14] | (packet[15] << 8)
+    length = (packet[16] << 8) | packet[17]
+    return full_universe, packet[18:18 + length]
+
+
+def run_reflector(sock, channel, output_net, output_subnet, stop):
+    """Mimics a node's probe echo, reporting zero software time."""
+    sock.settimeout(0.1)
+    while not stop.is_set():
+        try:
+            packet, sender = sock.recvfrom(2048)
+        except socket.timeout:
+            continue
+        parsed = parse_art_dmx(packet)
+        if parsed is None or len(parsed[1]) < channel:
+            continue
+        full_universe, data = parsed
+        # Like the node, echo on the output net/subnet with the same universe
+        echo_universe = (output_net << 8) | (output_subnet << 4) | (full_universe & 0x0F)
+        echo = bytearray(DMX_MAX_CHANNELS)
+        echo[channel - 1] = data[channel - 1]
+        sock.sendto(build_art_dmx(echo_universe, 0, echo), sender)
+
+
+def percentile(values, pct):
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def summarize(name, values_ms):
+    if not values_ms:
+        print(f"  {name:<19} no samples")
+        return
+    print(
+        f"  {name:<19} min {min(values_ms):7.2f}  p50 {percentile(values_ms, 50):7.2f}  "
+        f"p95 {percentile(values_ms, 95):7.2f}  p99 {percentile(values_ms, 99):7.2f}  "
+        f"max {max(values_ms):7.2f}  mean {statistics.mean(values_ms):7.2f} ms"
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("node", nargs="?", help="IP address of the node")
+    parser.add_argument("--universe", type=int, default=0, help="probe universe (0-15)")
+    parser.add_argument("--channel", type=int, default=1, help="probe channel (1-510)")
+    parser.add_argument("--net", type=int, default=0, help="net the node listens on (0-127)")
+    parser.add_argument("--subnet", type=int, default=0, help="subnet the node listens on (0-15)")
+    parser.add_argument("--output-net", type=int, default=0, help="net the node sends on (0-127)")
+    parser.add_argument("--output-subnet", type=int, default=0, help="subnet the node sends on (0-15)")
+    parser.add_argument("--count", type=int, default=200, help="number of probes to send")
+    parser.add_argument("--interval", type=float, default=0.05, help="seconds between probes")
+    parser.add_argument("--timeout", type=float, default=1.0, help="seconds to wait for each echo")
+    parser.add_argument("--loopback", action="store_true", help="probe a built-in reflector on localhost")
+    args = parser.parse_args()
+
+    if not args.loopback and not args.node:
+        parser.error("node address is required unless --loopback is given")
+    if not 1 <= args.channel <= 510:
+        parser.error("channel must be between 1 and 510")
+
+    stop = threading.Event()
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    if args.loopback:
+        # Use ephemeral ports so the benchmark never collides with a console on 6454
+        sock.bind(("127.0.0.1", 0))
+        reflector = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        reflector.bind(("127.0.0.1", 0))
+        target = reflector.getsockname()
+        threading.Thread(
+            target=run_reflector,
+            args=(reflector, args.channel, args.output_net, args.output_subnet, stop),
+            daemon=True,
+        ).start()
+    else:
+        # The node always sends to the Art-Net port
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        sock.bind(("", ART_NET_PORT))
+        target = (args.node, ART_NET_PORT)
+
+    send_universe = (args.net << 8) | (args.subnet << 4) | args.universe
+    echo_universe = (args.output_net << 8) | (args.output_subnet << 4) | args.universe
+
+    round_trip_ms, software_ms, other_ms = [], [], []
+    lost = 0
+    frame = bytearray(DMX_MAX_CHANNELS)
+    try:
+        for i in range(args.count):
+            # Cycle through 1-255 so an idle frame of zeros never matches
+            tag = i % 255 + 1
+            frame[args.channel - 1] = tag
+            packet = build_art_dmx(send_universe, i % 255 + 1, frame)
+
+            sent_at = time.perf_counter()
+            sock.sendto(packet, target)
+            deadline = sent_at + args.timeout
+            matched = False
+            while not matched:
+                remaining = deadline - time.perf_counter()
+                if remaining <= 0:
+                    break
+                sock.settimeout(remaining)
+                try:
+                    reply, _ = sock.recvfrom(2048)
+                except socket.timeout:
+                    break
+                received_at = time.perf_counter()
+                parsed = parse_art_dmx(reply)
+                if parsed is None or parsed[0] != echo_universe or len(parsed[1]) < args.channel + 2:
+                    continue
+                data = parsed[1]
+                if data[args.channel - 1] != tag:
+                    continue
+
+                matched = True
+                rtt = (received_at - sent_at) * 1000.0
+                node_ms = ((data[args.channel] << 8) | data[args.channel + 1]) / 1000.0
+                round_trip_ms.append(rtt)
+                software_ms.append(node_ms)
+                other_ms.append(max(0.0, rtt - node_ms))
+
+            if not matched:
+                lost += 1
+            time.sleep(args.interval)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stop.set()
+
+    print(f"Sent {args.count} probes, {len(round_trip_ms)} echoed, {lost} lost")
+    summarize("round-trip", round_trip_ms)
+    summarize("software", software_ms)
+    summarize("network + loop wait", other_ms)
+    return 0 if round_trip_ms else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())